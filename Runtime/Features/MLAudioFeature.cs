@@ -13,6 +13,7 @@ namespace NatML.Features {
     using System.Threading.Tasks;
     using System.Linq;
     using UnityEngine;
+    using Unity.Profiling;
     using Unity.Collections;
     using Unity.Collections.LowLevel.Unsafe;
     using API.Types;
@@ -211,6 +212,8 @@ namespace NatML.Features {
         private readonly float[] sampleBuffer;
         private readonly float* nativeBuffer;
         private readonly string path;
+        private static readonly ProfilerMarker CreateFeatureMarker = new ProfilerMarker(@"NatML.CreateAudioFeature");
+        private static readonly ProfilerMarker ReadNextFeatureMarker = new ProfilerMarker(@"NatML.ReadNextFeature");
 
         public ref float GetPinnableReference () => ref (nativeBuffer == null ? ref sampleBuffer[0] : ref *nativeBuffer);
 
@@ -221,7 +224,8 @@ namespace NatML.Features {
             var std = new float[channelCount];
             Array.Fill(mean, this.mean);
             Array.Fill(std, this.std);
-            fixed (float* data = this) {
+            fixed (float* data = this)
+            using (CreateFeatureMarker.Auto()) {
                 NatML.CreateFeature(
                     data,
                     audioType.sampleRate,
@@ -284,7 +288,9 @@ namespace NatML.Features {
                     // Read frame
                     feature.ReleaseFeature();
                     feature = IntPtr.Zero;
-                    reader.ReadNextFeature(out var timestamp, out feature);
+                    var timestamp = 0L;
+                    using (ReadNextFeatureMarker.Auto())
+                        reader.ReadNextFeature(out timestamp, out feature);
                     // EOS
                     if (timestamp < 0)
                         break;
@@ -8,7 +8,10 @@ namespace NatML.Features {
     using System;
     using System.Collections.Generic;
     using System.IO;
+    using System.Runtime.ExceptionServices;
+    using System.Threading.Tasks;
     using UnityEngine;
+    using Unity.Profiling;
     using UnityEngine.Experimental.Rendering;
     using Unity.Collections;
     using Unity.Collections.LowLevel.Unsafe;
@@ -71,6 +74,8 @@ namespace NatML.Features {
                 throw new ArgumentException(@"Cannot create image feature because texture is not readable", nameof(texture));
             if (texture.format == TextureFormat.RGBA32) // zero copy :D
                 this.nativeBuffer = texture.GetRawTextureData<byte>().GetUnsafeReadOnlyPtr();
+            else if (Swizzles.ContainsKey(texture.format)) // single copy :)
+                this.pixelBuffer = ToPixelBuffer(texture.GetRawTextureData<byte>(), texture.width, texture.height, texture.format);
             else // double copy :(
                 this.pixelBuffer = ToPixelBuffer(texture.GetPixels32(), texture.width, texture.height);
         }
@@ -198,9 +203,48 @@ namespace NatML.Features {
             var srcBuffer = this.nativeBuffer;
             var dstBuffer = destination.nativeBuffer;
             fixed (void* src = this, dst = destination)
+            using (CopyToMarker.Auto())
                 NatML.CopyTo(src, width, height, srcRect, rotation, (byte*)&background, dst);
         }
 
+        /// <summary>
+        /// Copy multiple image feature regions of interest into other features.
+        /// The regions are copied in parallel.
+        /// </summary>
+        /// <param name="destinations">Features to copy data into. These MUST be distinct.</param>
+        /// <param name="rects">ROI rectangles in pixel coordinates.</param>
+        /// <param name="rotations">Rectangle clockwise rotations in degrees. Pass `null` for no rotation.</param>
+        /// <param name="background">Background color for unmapped pixels.</param>
+        public void CopyTo (
+            IReadOnlyList<MLImageFeature> destinations,
+            IReadOnlyList<RectInt> rects,
+            IReadOnlyList<float> rotations = null,
+            Color32 background = default
+        ) {
+            // Check
+            if (rects.Count != destinations.Count)
+                throw new ArgumentException(@"ROI rectangle count does not match destination feature count", nameof(rects));
+            if (rotations != null && rotations.Count != destinations.Count)
+                throw new ArgumentException(@"Rotation count does not match destination feature count", nameof(rotations));
+            for (var i = 0; i < rects.Count; ++i)
+                if (rects[i].size.x != destinations[i].width || rects[i].size.y != destinations[i].height)
+                    throw new ArgumentOutOfRangeException(nameof(rects), $"ROI rectangle {i} size does not match destination feature size");
+            if (new HashSet<MLImageFeature>(destinations).Count != destinations.Count)
+                throw new ArgumentException(@"Destination features must be distinct", nameof(destinations));
+            // Copy
+            if (MLEdgeModel.Platform == RuntimePlatform.WebGLPlayer) {
+                for (var i = 0; i < destinations.Count; ++i)
+                    CopyTo(destinations[i], rects[i], rotations?[i] ?? 0f, background);
+                return;
+            }
+            try {
+                Parallel.For(0, destinations.Count, i => CopyTo(destinations[i], rects[i], rotations?[i] ?? 0f, background));
+            } catch (AggregateException ex) {
+                ExceptionDispatchInfo.Capture(ex.InnerException).Throw();
+                throw;
+            }
+        }
+
         /// <summary>
         /// Copy the image feature data into a texture.
         /// This method MUST only be used from the Unity main thread.
@@ -336,11 +380,19 @@ namespace NatML.Features {
         #region --Operations--
         private readonly byte[] pixelBuffer;
         private readonly void* nativeBuffer;
+        private static readonly Dictionary<TextureFormat, (int stride, int r, int g, int b, int a)> Swizzles = new () {
+            [TextureFormat.BGRA32] = (4, 2, 1, 0, 3),
+            [TextureFormat.ARGB32] = (4, 1, 2, 3, 0),
+            [TextureFormat.RGB24] = (3, 0, 1, 2, -1),
+        };
+        private static readonly ProfilerMarker CreateFeatureMarker = new ProfilerMarker(@"NatML.CreateImageFeature");
+        private static readonly ProfilerMarker CopyToMarker = new ProfilerMarker(@"NatML.ImageFeatureCopyTo");
 
         public ref byte GetPinnableReference () => ref (nativeBuffer == null ? ref pixelBuffer[0] : ref *(byte*)nativeBuffer);
 
         unsafe MLEdgeFeature IMLEdgeFeature.Create (MLFeatureType type) {
-            fixed (void* data = this) {
+            fixed (void* data = this)
+            using (CreateFeatureMarker.Auto()) {
                 var featureType = type as MLArrayType;
                 var meanArr = stackalloc [] { mean.x, mean.y, mean.z, mean.w };
                 var stdArr = stackalloc [] { std.x, std.y, std.z, std.w };
@@ -378,6 +430,20 @@ namespace NatML.Features {
                 Buffer.MemoryCopy(src, dst, pixelBuffer.Length, pixelBuffer.Length);
             return pixelBuffer;
         }
+
+        private static unsafe byte[] ToPixelBuffer (NativeArray<byte> textureData, int width, int height, TextureFormat format) {
+            var (stride, r, g, b, a) = Swizzles[format];
+            var pixelBuffer = new byte[width * height * 4];
+            var src = (byte*)textureData.GetUnsafeReadOnlyPtr();
+            fixed (byte* dst = pixelBuffer)
+                for (int i = 0, j = 0, k = 0, ilen = width * height; i < ilen; ++i, j += stride, k += 4) {
+                    dst[k + 0] = src[j + r];
+                    dst[k + 1] = src[j + g];
+                    dst[k + 2] = src[j + b];
+                    dst[k + 3] = a < 0 ? byte.MaxValue : src[j + a];
+                }
+            return pixelBuffer;
+        }
         #endregion
     }
 }
\ No newline at end of file
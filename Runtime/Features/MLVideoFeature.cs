@@ -10,6 +10,7 @@ namespace NatML.Features {
     using System.Collections.Generic;
     using System.Threading.Tasks;
     using UnityEngine;
+    using Unity.Profiling;
     using API.Types;
     using Internal;
     using Types;
@@ -84,6 +85,7 @@ namespace NatML.Features {
 
 
         #region --Operations--
+        private static readonly ProfilerMarker ReadNextFeatureMarker = new ProfilerMarker(@"NatML.ReadNextFeature");
 
         IEnumerator<(MLImageFeature, long)> IEnumerable<(MLImageFeature feature, long timestamp)>.GetEnumerator () {
             // Create reader
@@ -97,7 +99,9 @@ namespace NatML.Features {
                     // Read frame
                     feature.ReleaseFeature();
                     feature = IntPtr.Zero;
-                    reader.ReadNextFeature(out var timestamp, out feature);
+                    var timestamp = 0L;
+                    using (ReadNextFeatureMarker.Auto())
+                        reader.ReadNextFeature(out timestamp, out feature);
                     // EOS
                     if (timestamp < 0)
                         break;
@@ -7,7 +7,6 @@ namespace NatML.Internal {
 
     using System;
     using System.Runtime.InteropServices;
-    using System.Text;
     using Dtype = API.Types.Dtype;
 
     public static class NatML {
@@ -67,8 +66,8 @@ namespace NatML.Internal {
 
         #region --NMLModel--
         [DllImport(Assembly, EntryPoint = @"NMLCreateModel")]
-        public static extern void CreateModel (
-            byte[] buffer,
+        public static unsafe extern void CreateModel (
+            byte* buffer,
             long bufferSize,
             IntPtr options,
             ModelCreationHandler handler,
@@ -85,15 +84,15 @@ namespace NatML.Internal {
         public static extern void MetadataKey (
             this IntPtr model,
             int index,
-            [MarshalAs(UnmanagedType.LPStr)] StringBuilder dest,
+            [Out] byte[] dest,
             int size
         );
 
         [DllImport(Assembly, EntryPoint = @"NMLModelGetMetadataValue")]
         public static extern void MetadataValue (
             this IntPtr model,
-            [MarshalAs(UnmanagedType.LPStr)] string key,
-            [MarshalAs(UnmanagedType.LPStr)] StringBuilder dest,
+            [In] byte[] key,
+            [Out] byte[] dest,
             int size
         );
         [DllImport(Assembly, EntryPoint = @"NMLModelGetInputFeatureCount")]
@@ -195,7 +194,7 @@ namespace NatML.Internal {
         [DllImport(Assembly, EntryPoint = @"NMLFeatureTypeGetName")]
         public static extern void FeatureTypeName (
             this IntPtr type,
-            [MarshalAs(UnmanagedType.LPStr)] StringBuilder dest,
+            [Out] byte[] dest,
             int size
         );
 
@@ -6,7 +6,7 @@
 namespace NatML {
 
     using System;
-    using System.Collections.Concurrent;
+    using System.Collections.Generic;
     using System.Runtime.CompilerServices;
     using System.Threading;
     using System.Threading.Tasks;
@@ -23,6 +23,17 @@ namespace NatML {
         /// </summary>
         public readonly IMLPredictor<TOutput> predictor;
 
+        /// <summary>
+        /// Policy used when prediction requests are made faster than they can be processed.
+        /// </summary>
+        public readonly QueuePolicy policy;
+
+        /// <summary>
+        /// Maximum number of pending prediction requests.
+        /// This is `int.MaxValue` for the unbounded policy and one for the latest-only policy.
+        /// </summary>
+        public readonly int capacity;
+
         /// <summary>
         /// Whether the predictor is ready to process new requests immediately.
         /// </summary>
@@ -31,21 +42,30 @@ namespace NatML {
             [MethodImpl(MethodImplOptions.Synchronized)] private set;
         }
 
+        /// <summary>
+        /// Number of pending prediction requests.
+        /// </summary>
+        public int queueDepth {
+            get {
+                lock (queue)
+                    return queue.Count;
+            }
+        }
+
+        /// <summary>
+        /// Number of prediction requests that have been cancelled by the queue policy.
+        /// </summary>
+        public long droppedCount => Interlocked.Read(ref dropped);
+
         /// <summary>
         /// Make a prediction on one or more input features.
+        /// When the policy is `QueuePolicy.Backpressure`, the request is not queued until there is space in the queue.
         /// </summary>
         /// <param name="inputs">Input features.</param>
         /// <returns>Prediction output.</returns>
-        public Task<TOutput> Predict (params MLFeature[] inputs) {
-            var tcs = new TaskCompletionSource<TOutput>();
-            if (!fence.SafeWaitHandle.IsClosed) {
-                queue.Enqueue((inputs, tcs));
-                fence.Set();
-            }
-            else
-                tcs.SetCanceled();
-            return tcs.Task;
-        }
+        public Task<TOutput> Predict (params MLFeature[] inputs) => policy == QueuePolicy.Backpressure ?
+            PredictWhenAdmitted(inputs) :
+            Enqueue(inputs);
 
         /// <summary>
         /// Dispose the predictor and release resources.
@@ -53,51 +73,128 @@ namespace NatML {
         /// </summary>
         public void Dispose () {
             // Stop worker
-            cts.Cancel();
-            fence.Set();
+            lock (queue) {
+                cts.Cancel();
+                Monitor.PulseAll(queue);
+            }
             task.Wait();
             // Dispose
             cts.Dispose();
-            fence.Dispose();
             predictor.Dispose();
         }
         #endregion
 
 
         #region --Operations--
-        private readonly ConcurrentQueue<(MLFeature[] inputs, TaskCompletionSource<TOutput> tcs)> queue;
-        private readonly AutoResetEvent fence;
+        private readonly Queue<(MLFeature[] inputs, TaskCompletionSource<TOutput> tcs)> queue;
         private readonly CancellationTokenSource cts;
         private readonly Task task;
+        private readonly SemaphoreSlim slots;
+        private readonly CancellationToken token;
+        private long dropped;
 
-        internal MLAsyncPredictor (IMLPredictor<TOutput> predictor) {            
+        internal MLAsyncPredictor (
+            IMLPredictor<TOutput> predictor,
+            QueuePolicy policy = QueuePolicy.Unbounded,
+            int capacity = 1
+        ) {
+            // Check
+            if (capacity < 1 && (policy == QueuePolicy.DropOldest || policy == QueuePolicy.Backpressure))
+                throw new ArgumentOutOfRangeException(nameof(capacity), @"Queue capacity must be positive");
             // Save
             this.predictor = predictor;
-            this.queue = new ConcurrentQueue<(MLFeature[], TaskCompletionSource<TOutput>)>();
-            this.fence = new AutoResetEvent(false);
+            this.policy = policy;
+            this.capacity = policy switch {
+                QueuePolicy.Unbounded   => int.MaxValue,
+                QueuePolicy.LatestOnly  => 1,
+                _                       => capacity,
+            };
+            this.queue = new Queue<(MLFeature[], TaskCompletionSource<TOutput>)>();
             this.cts = new CancellationTokenSource();
+            this.token = cts.Token;
+            this.slots = policy == QueuePolicy.Backpressure ? new SemaphoreSlim(capacity) : null;
             this.task = new Task(() => {
-                while (!cts.Token.IsCancellationRequested) {
-                    if (queue.TryDequeue(out var request))
-                        try {
-                            readyForPrediction = false;
-                            var result = predictor.Predict(request.inputs);
-                            request.tcs.SetResult(result);
-                        } catch (Exception ex) {
-                            request.tcs.SetException(ex);
-                        } finally {
-                            readyForPrediction = true;
-                        }
-                    else
-                        fence.WaitOne();                    
+                for (;;) {
+                    // Dequeue
+                    (MLFeature[] inputs, TaskCompletionSource<TOutput> tcs) request;
+                    lock (queue) {
+                        while (queue.Count == 0 && !cts.IsCancellationRequested)
+                            Monitor.Wait(queue);
+                        if (cts.IsCancellationRequested)
+                            break;
+                        request = queue.Dequeue();
+                    }
+                    if (policy == QueuePolicy.Backpressure)
+                        slots.Release();
+                    // Predict
+                    try {
+                        readyForPrediction = false;
+                        var result = predictor.Predict(request.inputs);
+                        request.tcs.SetResult(result);
+                    } catch (Exception ex) {
+                        request.tcs.SetException(ex);
+                    } finally {
+                        readyForPrediction = true;
+                    }
                 }
-                while (queue.TryDequeue(out var request))
-                    request.tcs.SetCanceled();
-            }, cts.Token, TaskCreationOptions.LongRunning);
+                lock (queue)
+                    while (queue.Count > 0)
+                        queue.Dequeue().tcs.SetCanceled();
+            }, TaskCreationOptions.LongRunning);
             // Start
             task.Start();
             readyForPrediction = true;
         }
+
+        private async Task<TOutput> PredictWhenAdmitted (MLFeature[] inputs) {
+            await slots.WaitAsync(token).ConfigureAwait(false);
+            return await Enqueue(inputs).ConfigureAwait(false);
+        }
+
+        private Task<TOutput> Enqueue (MLFeature[] inputs) {
+            var tcs = new TaskCompletionSource<TOutput>(TaskCreationOptions.RunContinuationsAsynchronously);
+            lock (queue) {
+                // Check
+                if (cts.IsCancellationRequested) {
+                    tcs.SetCanceled();
+                    return tcs.Task;
+                }
+                // Make space
+                if (policy != QueuePolicy.Unbounded && policy != QueuePolicy.Backpressure)
+                    while (queue.Count >= capacity) {
+                        queue.Dequeue().tcs.SetCanceled();
+                        Interlocked.Increment(ref dropped);
+                    }
+                // Enqueue
+                queue.Enqueue((inputs, tcs));
+                Monitor.PulseAll(queue);
+            }
+            return tcs.Task;
+        }
         #endregion
     }
-}
\ No newline at end of file
+
+    /// <summary>
+    /// Policy used by an async predictor when prediction requests are made faster than they can be processed.
+    /// </summary>
+    public enum QueuePolicy : int {
+        /// <summary>
+        /// Queue every prediction request.
+        /// Latency and memory usage grow without bound when the predictor is overloaded.
+        /// </summary>
+        Unbounded       = 0,
+        /// <summary>
+        /// Cancel the oldest pending request when the queue is full.
+        /// </summary>
+        DropOldest      = 1,
+        /// <summary>
+        /// Cancel any pending request when a new request is made, so that only the latest request is processed.
+        /// </summary>
+        LatestOnly      = 2,
+        /// <summary>
+        /// Wait for space in the queue before queuing a request.
+        /// The calling thread is never blocked, but the returned task only completes once the request has been queued and processed.
+        /// </summary>
+        Backpressure    = 3,
+    }
+}
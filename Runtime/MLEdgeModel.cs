@@ -10,12 +10,19 @@ namespace NatML {
     using System;
     using System.Collections;
     using System.Collections.Generic;
+    using System.Diagnostics;
     using System.IO;
+    using System.IO.MemoryMappedFiles;
     using System.Linq;
+    using System.Runtime.CompilerServices;
     using System.Runtime.InteropServices;
     using System.Text;
+    using System.Threading;
     using System.Threading.Tasks;
     using UnityEngine;
+    using Unity.Profiling;
+    using Unity.Collections;
+    using Unity.Collections.LowLevel.Unsafe;
     using Newtonsoft.Json;
     using API;
     using API.Types;
@@ -25,7 +32,8 @@ namespace NatML {
 
     /// <summary>
     /// ML model that makes edge (on-device) predictions with a predictor graph.
-    /// Edge models are NOT thread safe, so predictions MUST be made from one thread at a time.
+    /// Models can be created and used on different threads.
+    /// Predictions can be made from multiple threads, but are run one at a time on each model.
     /// </summary>
     public sealed class MLEdgeModel : MLModel {
 
@@ -130,6 +138,30 @@ namespace NatML {
         /// </summary>
         public AudioFormat? audioFormat => session.predictor?.audioFormat;
 
+        /// <summary>
+        /// Time taken to create the model in milliseconds.
+        /// This includes session lookup and graph loading when the model is created from a tag or path.
+        /// </summary>
+        public double creationTime { get; private set; }
+
+        /// <summary>
+        /// Wall-clock durations of the most recent predictions in milliseconds, from oldest to newest.
+        /// This measures the native prediction call, excluding input feature creation.
+        /// </summary>
+        public double[] predictionTimes {
+            get {
+                lock (predictionLock) {
+                    var count = (int)Math.Min(predictionCount, predictionTicks.Length);
+                    var result = new double[count];
+                    for (var i = 0; i < count; ++i) {
+                        var idx = (predictionCount - count + i) % predictionTicks.Length;
+                        result[i] = 1e+3 * predictionTicks[idx] / Stopwatch.Frequency;
+                    }
+                    return result;
+                }
+            }
+        }
+
         /// <summary>
         /// Make a prediction on one or more edge features.
         /// Input and output features MUST be disposed when no longer needed.
@@ -137,20 +169,98 @@ namespace NatML {
         /// <param name="inputs">Input edge features.</param>
         /// <returns>Output edge features.</returns>
         public MLFeatureCollection<MLEdgeFeature> Predict (params MLEdgeFeature[] inputs) {
-            Array.Clear(rawInputFeatures, 0, rawInputFeatures.Length);
-            Array.Clear(rawOutputFeatures, 0, rawOutputFeatures.Length);
-            for (var i = 0; i < rawInputFeatures.Length; ++i)
-                rawInputFeatures[i] = inputs[i];
-            model.Predict(rawInputFeatures, rawOutputFeatures);
-            for (var i = 0; i < rawOutputFeatures.Length; ++i)
-                outputFeatures[i] = new MLEdgeFeature(rawOutputFeatures[i]);
-            return outputFeatures;
+            var outputs = new MLEdgeFeature[rawOutputFeatures.Length];
+            Predict(inputs, outputs);
+            return outputs;
+        }
+
+        /// <summary>
+        /// Make a prediction on one or more edge features, writing output features into a caller-owned array.
+        /// This avoids any managed allocations, so the output array can be reused across predictions.
+        /// Input and output features MUST be disposed when no longer needed.
+        /// </summary>
+        /// <param name="inputs">Input edge features.</param>
+        /// <param name="outputs">Destination array for output edge features. This MUST have one element for each model output.</param>
+        public void Predict (MLEdgeFeature[] inputs, MLEdgeFeature[] outputs) => Predict(inputs, outputs, true);
+
+        /// <summary>
+        /// Make predictions on a batch of edge feature sets.
+        /// Each input set is predicted in turn.
+        /// Input and output features MUST be disposed when no longer needed.
+        /// </summary>
+        /// <param name="inputs">Input edge feature sets.</param>
+        /// <returns>Output edge features for each input set.</returns>
+        public MLFeatureCollection<MLEdgeFeature>[] Predict (IReadOnlyList<MLEdgeFeature[]> inputs) {
+            var result = new MLFeatureCollection<MLEdgeFeature>[inputs.Count];
+            var i = 0;
+            try {
+                for (; i < result.Length; ++i) {
+                    var outputs = new MLEdgeFeature[rawOutputFeatures.Length];
+                    Predict(inputs[i], outputs);
+                    result[i] = outputs;
+                }
+            } catch {
+                for (var j = 0; j < i; ++j)
+                    result[j].Dispose();
+                throw;
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Warm up the model by making a prediction on zero-filled input features.
+        /// This moves one-time memory allocation and kernel selection out of the first prediction.
+        /// This method can be called from a worker thread.
+        /// </summary>
+        /// <param name="shapes">Optional input feature shapes. This MUST be specified for inputs with dynamic dimensions.</param>
+        public unsafe void Warmup (params int[]?[]? shapes) {
+            shapes ??= new int[0][];
+            var inputFeatures = new MLEdgeFeature[inputs.Length];
+            var outputFeatures = new MLEdgeFeature[rawOutputFeatures.Length];
+            var buffers = new IntPtr[inputs.Length];
+            try {
+                // Create inputs
+                for (var i = 0; i < inputs.Length; ++i) {
+                    // Check type
+                    var type = inputs[i] as MLArrayType;
+                    var dtype = type?.dataType?.ToDtype() ?? Dtype.Undefined;
+                    if (type == null || dtype == Dtype.Undefined)
+                        throw new InvalidOperationException($"Cannot warm up model because input feature {i} is not a numeric array feature");
+                    // Check shape
+                    var shape = i < shapes.Length ? shapes[i] ?? type.shape : type.shape;
+                    if (shape == null || Array.IndexOf(shape, -1) >= 0)
+                        throw new ArgumentException($"Input feature {i} has a dynamic shape so its shape must be specified", nameof(shapes));
+                    // Create feature
+                    var size = shape.Aggregate(1, (a, b) => a * b) * Marshal.SizeOf(type.dataType);
+                    var buffer = UnsafeUtility.Malloc(size, 16, Allocator.Persistent);
+                    UnsafeUtility.MemClear(buffer, size);
+                    buffers[i] = (IntPtr)buffer;
+                    NatML.CreateFeature(buffer, shape, shape.Length, dtype, 0, out var feature);
+                    inputFeatures[i] = new MLEdgeFeature(feature);
+                }
+                // Predict without recording the prediction time
+                Predict(inputFeatures, outputFeatures, false);
+            } finally {
+                foreach (var feature in inputFeatures)
+                    feature.Dispose();
+                foreach (var feature in outputFeatures)
+                    feature.Dispose();
+                foreach (var buffer in buffers)
+                    if (buffer != IntPtr.Zero)
+                        UnsafeUtility.Free((void*)buffer, Allocator.Persistent);
+            }
         }
 
         /// <summary>
         /// Dispose the model and release resources.
         /// </summary>
-        public override void Dispose () => model.ReleaseModel();
+        [MethodImpl(MethodImplOptions.Synchronized)]
+        public override void Dispose () {
+            if (disposed)
+                return;
+            model.ReleaseModel();
+            disposed = true;
+        }
 
         /// <summary>
         /// Create an edge ML model.
@@ -176,13 +286,14 @@ namespace NatML {
             NatMLClient client
         ) {
             // Defines
-            PredictorSession session;
-            byte[] graph;
+            var startTime = Stopwatch.GetTimestamp();
+            MLEdgeModel model;
             // Handle tag
             if (Tag.TryParse(tagOrPath, out var tag)) {
-                session = SessionFromCache(tag.ToString()) ?? await SessionFromHub(tag, client);
-                graph = await LoadSessionGraph(session, client);
-                await CacheSession(session, graph);
+                var (session, graph) = await LoadSession(tag.ToString(), client);
+                model = graph != null ?
+                    await Create(session, graph, configuration) :
+                    await Create(session, GetGraphCachePath(session.fingerprint), configuration);
             }
             // Handle file
             else {
@@ -190,17 +301,57 @@ namespace NatML {
                 var format = FormatForFile(tagOrPath);
                 if (format == null)
                     throw new ArgumentException(@"Model file is not a recognized ML model format", nameof(tagOrPath));
-                // Read graph and session
-                using var stream = new FileStream(tagOrPath, FileMode.Open, FileAccess.Read);
-                graph = new byte[stream.Length];
-                await stream.ReadAsync(graph, 0, graph.Length);
-                session = new PredictorSession { format = format.Value };
+                // Create
+                var session = new PredictorSession { format = format.Value };
+                model = await Create(session, tagOrPath, configuration);
             }
             // Return
-            var model = await Create(session, graph, configuration);
+            model.creationTime = 1e+3 * (Stopwatch.GetTimestamp() - startTime) / Stopwatch.Frequency;
             return model;
         }
 
+        /// <summary>
+        /// Create multiple edge ML models concurrently.
+        /// Models loaded from files are created on worker threads.
+        /// Models loaded from tags are created on the calling thread, but their network requests are overlapped.
+        /// </summary>
+        /// <param name="tagsOrPaths">Predictor tags or paths to model files.</param>
+        /// <param name="configuration">Optional model configuration used for all models.</param>
+        /// <param name="accessKey">NatML access key.</param>
+        /// <param name="maxConcurrency">Maximum number of models to create at once. Pass zero to use the processor count.</param>
+        /// <returns>Edge models in the same order as the given tags or paths.</returns>
+        public static async Task<MLEdgeModel[]> Create (
+            IReadOnlyList<string> tagsOrPaths,
+            Configuration? configuration = null,
+            string? accessKey = null,
+            int maxConcurrency = 0
+        ) {
+            // Create
+            var client = MLUnityExtensions.CreateClient(accessKey);
+            using var semaphore = new SemaphoreSlim(maxConcurrency > 0 ? maxConcurrency : Environment.ProcessorCount);
+            var tasks = tagsOrPaths.Select(async tagOrPath => {
+                await semaphore.WaitAsync();
+                try {
+                    var offload = !Tag.TryParse(tagOrPath, out _) && Platform != RuntimePlatform.WebGLPlayer;
+                    return await (offload ?
+                        Task.Run(() => Create(tagOrPath, configuration, client)) :
+                        Create(tagOrPath, configuration, client)
+                    );
+                } finally {
+                    semaphore.Release();
+                }
+            }).ToArray();
+            // Wait
+            try {
+                return await Task.WhenAll(tasks);
+            } catch {
+                foreach (var task in tasks)
+                    if (task.Status == TaskStatus.RanToCompletion)
+                        task.Result.Dispose();
+                throw;
+            }
+        }
+
         /// <summary>
         /// Create an edge ML model.
         /// </summary>
@@ -218,49 +369,78 @@ namespace NatML {
         private readonly PredictorSession session;
         private readonly IntPtr[] rawInputFeatures;
         private readonly IntPtr[] rawOutputFeatures;
-        private readonly MLEdgeFeature[] outputFeatures; // prevent GC
+        private bool disposed;
+        private readonly object predictionLock = new object();
+        private readonly long[] predictionTicks = new long[64];
+        private long predictionCount;
         private static string CachePath = string.Empty;
-        private static RuntimePlatform Platform = 0;
+        private static readonly Dictionary<string, Task<(PredictorSession session, byte[]? graph)>> SessionRequests = new Dictionary<string, Task<(PredictorSession, byte[]?)>>();
+        internal static RuntimePlatform Platform { get; private set; } = 0;
         private static string Device = string.Empty;
         private const string Extension = @".nml";
+        private static readonly ProfilerMarker CreateModelMarker = new ProfilerMarker(@"NatML.CreateModel");
+        private static readonly ProfilerMarker PredictMarker = new ProfilerMarker(@"NatML.Predict");
 
         private unsafe MLEdgeModel (IntPtr model, PredictorSession session) {
             this.model = model;
             this.session = session;
+            var buffer = new byte[8192];
             // Marshal input types
             this.inputs = new MLFeatureType[model.InputFeatureCount()];
             this.rawInputFeatures = new IntPtr[this.inputs.Length];
             for (var i = 0; i < inputs.Length; ++i) {
                 model.InputFeatureType(i, out var type);
-                inputs[i] = CreateFeatureType(type);
+                inputs[i] = CreateFeatureType(type, buffer);
                 type.ReleaseFeatureType();
             }
             // Marshal output types
             this.outputs = new MLFeatureType[model.OutputFeatureCount()];
             this.rawOutputFeatures = new IntPtr[this.outputs.Length];
-            this.outputFeatures = new MLEdgeFeature[this.outputs.Length];
             for (var i = 0; i < outputs.Length; ++i) {
                 model.OutputFeatureType(i, out var type);
-                outputs[i] = CreateFeatureType(type);
+                outputs[i] = CreateFeatureType(type, buffer);
                 type.ReleaseFeatureType();
             }
             // Marshal dictionary
             var metadata = new Dictionary<string, string>();
             var count = model.MetadataCount();
-            var metadataBuffer = new StringBuilder(8192);
+            var keyBuffer = new byte[buffer.Length];
             for (var i = 0; i < count; ++i) {
-                metadataBuffer.Clear();
-                model.MetadataKey(i, metadataBuffer, metadataBuffer.Capacity);
-                var key = metadataBuffer.ToString();
-                metadataBuffer.Clear();
-                model.MetadataValue(key, metadataBuffer, metadataBuffer.Capacity);
-                var value = metadataBuffer.ToString();
+                keyBuffer[0] = 0;
+                model.MetadataKey(i, keyBuffer, keyBuffer.Length);
+                var key = DecodeString(keyBuffer);
+                buffer[0] = 0;
+                model.MetadataValue(keyBuffer, buffer, buffer.Length);
+                var value = DecodeString(buffer);
                 if (!string.IsNullOrEmpty(value))
                     metadata.Add(key, value);
             }
             this.metadata = metadata;
         }
 
+        [MethodImpl(MethodImplOptions.Synchronized)]
+        private void Predict (MLEdgeFeature[] inputs, MLEdgeFeature[] outputs, bool profile) {
+            // Check
+            if (disposed)
+                throw new ObjectDisposedException(nameof(MLEdgeModel));
+            if (outputs.Length < rawOutputFeatures.Length)
+                throw new ArgumentException(@"Output array must have one element for each model output", nameof(outputs));
+            // Predict
+            Array.Clear(rawInputFeatures, 0, rawInputFeatures.Length);
+            Array.Clear(rawOutputFeatures, 0, rawOutputFeatures.Length);
+            for (var i = 0; i < rawInputFeatures.Length; ++i)
+                rawInputFeatures[i] = inputs[i];
+            var startTime = Stopwatch.GetTimestamp();
+            using (PredictMarker.Auto())
+                model.Predict(rawInputFeatures, rawOutputFeatures);
+            var elapsedTicks = Stopwatch.GetTimestamp() - startTime;
+            if (profile)
+                lock (predictionLock)
+                    predictionTicks[predictionCount++ % predictionTicks.Length] = elapsedTicks;
+            for (var i = 0; i < rawOutputFeatures.Length; ++i)
+                outputs[i] = new MLEdgeFeature(rawOutputFeatures[i]);
+        }
+
         public override string ToString () {
             var attribs = new List<string> { GetType().Name };
             for (var i = 0; i < inputs.Length; ++i)
@@ -270,7 +450,37 @@ namespace NatML {
             return string.Join(Environment.NewLine, attribs);
         }
 
-        private static Task<MLEdgeModel> Create (PredictorSession session, byte[] graph, Configuration? config) {
+        private static unsafe Task<MLEdgeModel> Create (PredictorSession session, byte[] graph, Configuration? config) {
+            fixed (byte* buffer = graph)
+                return Create(session, buffer, graph.Length, config);
+        }
+
+        /// <summary>
+        /// Create an edge model from a graph file.
+        /// The file is memory-mapped so that the graph is never copied into managed memory.
+        /// </summary>
+        private static unsafe Task<MLEdgeModel> Create (PredictorSession session, string path, Configuration? config) {
+            // WebGL has no memory-mapped files
+            if (Platform == RuntimePlatform.WebGLPlayer)
+                return Create(session, File.ReadAllBytes(path), config);
+            // Check
+            var length = new FileInfo(path).Length;
+            if (length == 0)
+                throw new ArgumentException(@"Failed to create MLModel from graph data");
+            // Map file
+            using var file = MemoryMappedFile.CreateFromFile(path, FileMode.Open, null, 0, MemoryMappedFileAccess.Read);
+            using var view = file.CreateViewAccessor(0, length, MemoryMappedFileAccess.Read);
+            var buffer = (byte*)null;
+            view.SafeMemoryMappedViewHandle.AcquirePointer(ref buffer);
+            // Create
+            try {
+                return Create(session, buffer + view.PointerOffset, length, config);
+            } finally {
+                view.SafeMemoryMappedViewHandle.ReleasePointer();
+            }
+        }
+
+        private static unsafe Task<MLEdgeModel> Create (PredictorSession session, byte* graph, long length, Configuration? config) {
             // Check format
             if (session.format != FormatForPlatform(Platform))
                 throw new InvalidOperationException($"Cannot deserialize {session.format} graph on current platform");
@@ -284,7 +494,8 @@ namespace NatML {
             var tcs = new TaskCompletionSource<MLEdgeModel>();
             var request = new ModelCreationRequest (session, tcs);
             var context = (IntPtr)GCHandle.Alloc(request, GCHandleType.Normal);
-            NatML.CreateModel(graph, graph.Length, configuration, OnCreateModel, context);
+            using (CreateModelMarker.Auto())
+                NatML.CreateModel(graph, length, configuration, OnCreateModel, context);
             configuration.ReleaseModelConfiguration();
             return tcs.Task;
         }
@@ -330,7 +541,9 @@ namespace NatML {
             var session = request.session;
             var tcs = request.tcs;
             if (model != IntPtr.Zero)
-                tcs.SetResult(new MLEdgeModel(model, session));
+                tcs.SetResult(new MLEdgeModel(model, session) {
+                    creationTime = 1e+3 * (Stopwatch.GetTimestamp() - request.startTime) / Stopwatch.Frequency
+                });
             else
                 tcs.SetException(new ArgumentException(@"Failed to create MLModel from graph data"));
         }
@@ -358,6 +571,36 @@ namespace NatML {
 
 
         #region --Utilitiess--
+        /// <summary>
+        /// Load a graph prediction session and its graph, caching both.
+        /// Concurrent requests for the same predictor tag share a single load.
+        /// </summary>
+        /// <param name="tag">Predictor tag.</param>
+        /// <param name="client">NatML API client.</param>
+        /// <returns>Graph prediction session and graph data, or `null` graph data if the graph is in the local cache.</returns>
+        private static Task<(PredictorSession session, byte[]? graph)> LoadSession (string tag, NatMLClient client) {
+            lock (SessionRequests) {
+                // Check pending
+                if (SessionRequests.TryGetValue(tag, out var pending))
+                    return pending;
+                // Load
+                var request = LoadSessionUnshared(tag, client);
+                SessionRequests[tag] = request;
+                request.ContinueWith(_ => {
+                    lock (SessionRequests)
+                        SessionRequests.Remove(tag);
+                }, TaskContinuationOptions.ExecuteSynchronously);
+                return request;
+            }
+        }
+
+        private static async Task<(PredictorSession session, byte[]? graph)> LoadSessionUnshared (string tag, NatMLClient client) {
+            var session = SessionFromCache(tag) ?? await SessionFromHub(tag, client);
+            var graph = await LoadSessionGraph(session, client);
+            await CacheSession(session, graph);
+            return (session, graph);
+        }
+
         /// <summary>
         /// Load a graph prediction session from the local cache.
         /// </summary>
@@ -404,23 +647,20 @@ namespace NatML {
         }
 
         /// <summary>
+        /// Load the graph for a prediction session.
         /// </summary>
-        /// <param name="session"></param>
-        /// <param name="client"></param>
-        /// <returns></returns>
-        private static async Task<byte[]> LoadSessionGraph (PredictorSession session, NatMLClient client) {
+        /// <param name="session">Graph prediction session.</param>
+        /// <param name="client">NatML API client.</param>
+        /// <returns>Graph data or `null` if the graph is in the local cache.</returns>
+        private static async Task<byte[]?> LoadSessionGraph (PredictorSession session, NatMLClient client) {
             // Check embed
             var embeddedData = NatMLSettings.Instance.embeds.FirstOrDefault(embed => embed.fingerprint == session.fingerprint);
             if (embeddedData != null)
                 return embeddedData.data;
             // Check cached graph
             var path = GetGraphCachePath(session.fingerprint);
-            if (File.Exists(path)) {
-                using var fileStream = new FileStream(path, FileMode.Open, FileAccess.Read);
-                var graph = new byte[fileStream.Length];
-                await fileStream.ReadAsync(graph, 0, graph.Length);
-                return graph;
-            }
+            if (File.Exists(path))
+                return null;
             // Download graph
             using var stream = await client.Storage.Download(session.graph);
             return stream.ToArray();            
@@ -430,8 +670,8 @@ namespace NatML {
         /// Cache a graph prediction session.
         /// </summary>
         /// <param name="session">Graph prediction session.</param>
-        /// <param name="tag">Graph tag.</param>
-        private static async Task CacheSession (PredictorSession session, byte[] graph) {
+        /// <param name="graph">Graph data or `null` if the graph is already in the local cache.</param>
+        private static async Task CacheSession (PredictorSession session, byte[]? graph) {
             // Check if cached
             var sessionPath = GetSessionCachePath(session.predictor.tag);
             if (File.Exists(sessionPath))
@@ -440,15 +680,30 @@ namespace NatML {
             if (session.predictor.status == PredictorStatus.Draft || Platform == RuntimePlatform.WebGLPlayer)
                 return;
             // Write graph
-            var graphPath = GetGraphCachePath(session.fingerprint);
             Directory.CreateDirectory(CachePath);
-            using var graphStream = new FileStream(graphPath, FileMode.Create, FileAccess.Write, FileShare.None);
-            await graphStream.WriteAsync(graph, 0, graph.Length);
+            if (graph != null)
+                await WriteCacheFile(GetGraphCachePath(session.fingerprint), graph);
             // Write session
             session.graph = string.Empty;
             var sessionStr = JsonConvert.SerializeObject(session);
-            using var sessionStream = new StreamWriter(sessionPath);
-            await sessionStream.WriteAsync(sessionStr);
+            await WriteCacheFile(sessionPath, Encoding.UTF8.GetBytes(sessionStr));
+        }
+
+        /// <summary>
+        /// Write a file into the cache.
+        /// The data is written to a temporary file which is then moved into place, so that cached files are never partially written.
+        /// </summary>
+        /// <param name="path">Cache file path.</param>
+        /// <param name="data">File data.</param>
+        private static async Task WriteCacheFile (string path, byte[] data) {
+            var tempPath = $"{path}.{Guid.NewGuid():N}.tmp";
+            using (var stream = new FileStream(tempPath, FileMode.CreateNew, FileAccess.Write, FileShare.None))
+                await stream.WriteAsync(data, 0, data.Length);
+            try {
+                File.Move(tempPath, path);
+            } catch (IOException) when (File.Exists(path)) {
+                File.Delete(tempPath); // another writer cached the same file first
+            }
         }
 
         /// <summary>
@@ -505,16 +760,17 @@ namespace NatML {
         /// Convert a native `NMLFeatureType` to a managed `MLFeatureType`.
         /// </summary>
         /// <param name="nativeType">Native `NMLFeatureType`.</param>
+        /// <param name="buffer">Scratch buffer used to marshal the feature name.</param>
         /// <returns>Managed feature type.</returns>
-        private static MLFeatureType? CreateFeatureType (in IntPtr type) {
+        private static MLFeatureType? CreateFeatureType (in IntPtr type, byte[] buffer) {
             // Get dtype
             var dtype = type.FeatureTypeDataType();
             if (dtype == Dtype.Undefined)
                 return null;
             // Get name
-            var nameBuffer = new StringBuilder(2048);
-            type.FeatureTypeName(nameBuffer, nameBuffer.Capacity);
-            var name = nameBuffer.Length > 0 ? nameBuffer.ToString() : null;
+            buffer[0] = 0;
+            type.FeatureTypeName(buffer, buffer.Length);
+            var name = buffer[0] != 0 ? DecodeString(buffer) : null;
             // Get shape
             var shape = new int[type.FeatureTypeDimensions()];
             type.FeatureTypeShape(shape, shape.Length);
@@ -527,14 +783,26 @@ namespace NatML {
             }
         }
 
+        /// <summary>
+        /// Decode a null-terminated UTF-8 string written by the native library.
+        /// </summary>
+        /// <param name="buffer">String buffer.</param>
+        /// <returns>Decoded string.</returns>
+        private static string DecodeString (byte[] buffer) {
+            var length = Array.IndexOf(buffer, (byte)0);
+            return Encoding.UTF8.GetString(buffer, 0, length < 0 ? buffer.Length : length);
+        }
+
         private sealed class ModelCreationRequest {
 
             public readonly PredictorSession session;
             public readonly TaskCompletionSource<MLEdgeModel> tcs;
+            public readonly long startTime;
 
             public ModelCreationRequest (PredictorSession session, TaskCompletionSource<MLEdgeModel> tcs) {
                 this.session = session;
                 this.tcs = tcs;
+                this.startTime = Stopwatch.GetTimestamp();
             }
         }
         #endregion
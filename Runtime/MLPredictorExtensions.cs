@@ -16,9 +16,15 @@ namespace NatML {
         /// This typically results in significant performance improvements as predictions are run on a worker thread.
         /// </summary>
         /// <param name="predictor">Backing predictor to create an async predictor with.</param>
+        /// <param name="policy">Policy used when prediction requests are made faster than they can be processed.</param>
+        /// <param name="capacity">Maximum number of pending prediction requests. This is ignored for unbounded and latest-only policies.</param>
         /// <returns>Async predictor which runs predictions on a worker thread.</returns>
-        public static MLAsyncPredictor<TOutput> ToAsync<TOutput> (this IMLPredictor<TOutput> predictor) {
-            return new MLAsyncPredictor<TOutput>(predictor);
+        public static MLAsyncPredictor<TOutput> ToAsync<TOutput> (
+            this IMLPredictor<TOutput> predictor,
+            QueuePolicy policy = QueuePolicy.Unbounded,
+            int capacity = 1
+        ) {
+            return new MLAsyncPredictor<TOutput>(predictor, policy, capacity);
         }
         #endregion
     }